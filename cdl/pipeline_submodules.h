@@ -45,6 +45,21 @@ module reve_r_i32c_decode( input t_reve_r_inst instruction,
     timing comb output idecode;
 }
 
+/*m reve_r_i32_fuse  */
+extern
+module reve_r_i32_fuse( input bit[32]         pc,
+                        input t_reve_r_decode idecode,
+                        input t_reve_r_decode pair_idecode,
+                        output bit            fused,
+                        output t_reve_r_decode fused_idecode,
+                        output bit[32]        fused_offset,
+                        input  t_reve_r_config riscv_config
+)
+{
+    timing comb input pc, idecode, pair_idecode, riscv_config;
+    timing comb output fused, fused_idecode, fused_offset;
+}
+
 /*m reve_r_alu  */
 extern
 module reve_r_alu( input t_reve_r_decode      idecode,
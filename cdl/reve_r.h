@@ -60,6 +60,10 @@ typedef struct {
     bit      e32;
     bit      i32m;
     bit      i32m_fuse;
+    bit      i32a;            // if set, decode RV32A atomics (which require a memory system that supports atomic requests)
+    bit      i32_zbc;         // if set, decode Zbc carry-less multiplies (which require a carry-less multiply coprocessor)
+    bit      i32p;            // if set, decode the packed SIMD (draft P) subset that the ALU performs
+    bit      i32p_mul;        // if set (with i32p), decode the packed SIMD dual multiplies (which require a packed multiply coprocessor)
     bit      debug_enable;
     bit      coproc_disable;
     bit      unaligned_mem;   // if clear, trap on unaligned memory loads/stores
@@ -0,0 +1,56 @@
+/** @copyright (C) 2016-2020,  Gavin J Stark.  All rights reserved.
+ *
+ * @copyright
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0.
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ * @file   reve_r_burst.h
+ * @brief  Types for the Reve-R cache burst memory interface
+ *
+ */
+
+/*a Includes */
+include "reve_r.h"
+
+/*a Types */
+/*t t_reve_r_burst_req
+ *
+ * Burst request from a cache to the next level of memory.
+ *
+ * A request is presented with valid, and is taken when the response
+ * ack is asserted. For a read the memory then returns num_beats_m1+1
+ * words with read_valid, in order. For a write the cache presents
+ * num_beats_m1+1 words of write data with write_valid, each taken
+ * when the response write_ack is asserted; the first word may be
+ * presented with the request. A cache writing back a whole line
+ * enables all the bytes of each word; a write-through of a single
+ * word enables only the bytes written.
+ *
+ */
+typedef struct {
+    bit           valid          "Asserted if a burst is requested";
+    bit           read_not_write "Asserted for a read burst, deasserted for a write burst";
+    bit[32]       address        "Word-aligned address of the first word of the burst";
+    bit[4]        num_beats_m1   "Number of words in the burst, less one";
+    t_reve_r_mode mode           "Mode of the access that caused the burst";
+    bit           write_valid    "Asserted if write_data is valid for a write burst";
+    bit[32]       write_data     "Data for the next word of a write burst";
+    bit[4]        write_byte_enable "Bytes of write_data to be written";
+} t_reve_r_burst_req;
+
+/*t t_reve_r_burst_resp
+ */
+typedef struct {
+    bit           ack            "Asserted if a valid burst request is taken in this cycle";
+    bit           read_valid     "Asserted if read_data (and read_error) is valid for the next word of a read burst";
+    bit[32]       read_data      "Data for the next word of a read burst";
+    bit           read_error     "Asserted if the read of the word failed";
+    bit           write_ack      "Asserted if valid write data is taken in this cycle";
+} t_reve_r_burst_resp;
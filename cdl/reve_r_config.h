@@ -4,8 +4,14 @@ constant integer rv_cfg_i32c_force_disable=0;
 constant integer rv_cfg_e32_force_enable=0;
 constant integer rv_cfg_i32m_force_disable=0;
 constant integer rv_cfg_i32m_fuse_force_disable=0;
+constant integer rv_cfg_i32a_force_disable=0;
+constant integer rv_cfg_i32_zbc_force_disable=0;
+constant integer rv_cfg_i32p_force_disable=0;
 constant integer rv_cfg_i32_bitmap_enhanced_shift_enable=1;
 constant integer rv_cfg_i32_bitmap_others_enable=1;
+constant integer rv_cfg_i32_zba_enable=1;
+constant integer rv_cfg_i32_zbb_enable=1;
+constant integer rv_cfg_i32_zbs_enable=1;
 constant integer rv_cfg_i32_custom0_enable=0;
 constant integer rv_cfg_i32_custom0_as_load=1;
 constant integer rv_cfg_i32_custom0_as_store=0;
@@ -25,6 +31,24 @@ constant integer rv_cfg_debug_force_disable=0;
 constant integer rv_cfg_supervisor_mode_enable=0;
 constant integer rv_cfg_user_mode_enable=1;
 constant integer rv_cfg_user_irq_mode_enable=0;
+constant integer rv_cfg_bht_enable=0;
+constant integer rv_cfg_bht_entries=64;
+constant integer rv_cfg_bht_gshare_enable=0;
+constant integer rv_cfg_bht_history_length=8;
+constant integer rv_cfg_btb_enable=0;
+constant integer rv_cfg_btb_entries=8;
+constant integer rv_cfg_ras_enable=0;
+constant integer rv_cfg_ras_depth=4;
+constant integer rv_cfg_jump_fold_enable=0;
+constant integer rv_cfg_jump_fold_entries=4;
+constant integer rv_cfg_loop_buffer_enable=0;
+constant integer rv_cfg_dec_branch_resolve_enable=0;
+constant integer rv_cfg_dec_jalr_target_enable=0;
+constant integer rv_cfg_load_use_forward_enable=0;
+constant integer rv_cfg_load_use_forward_store_enable=0;
+constant integer rv_cfg_load_use_forward_registered_enable=0;
+constant integer rv_cfg_coproc_scoreboard_enable=0;
+constant integer rv_cfg_i32_fuse_enable=0;
 
 /*a CSR constants */
 constant integer mimpid = 0;
@@ -33,6 +33,8 @@ typedef struct {
     bit                     alu_cannot_start "Late in cycle: If asserted, alu_idecode may be valid but rs1/rs2 are not; once deasserted it remains deasserted until a new ALU instruction starts";
     bit                     alu_data_not_ready   "Early in cycle (independent of coprocessors): If asserted, alu_idecode may be valid but rs1/rs2 are not; once deasserted it remains deasserted until a new ALU instruction starts";
     bit                     alu_cannot_complete "Late in cycle: If asserted, alu cannot complete because it is still working on its operation";
+    bit                     alu_retire          "Late in cycle: If asserted, the ALU instruction is completing and will not be flushed";
+    bit                     alu_may_writeback_late "If asserted, the pipeline has a register scoreboard, and the coprocessor may let an instruction retire before its result is ready";
 } t_reve_r_coproc_controls;
 
 /*t t_reve_r_coproc_response
@@ -42,6 +44,10 @@ typedef struct {
     bit[32] result;
     bit          result_valid "Early in cycle, if asserted then coproc overcomes the ALU result";
     bit          cannot_complete "Early in cycle: if deasserted the module is performing a calculation that has not produced a valid result yet (feeds back in to controls alu_cannot_complete)";
+    bit          writeback_late  "Early in cycle: if asserted (only if alu_may_writeback_late) the ALU instruction may retire, and its result will be provided later with writeback_valid";
+    bit          writeback_valid "If asserted then writeback_data is written to register writeback_rd in this cycle, for an instruction that retired with writeback_late";
+    bit[5]       writeback_rd;
+    bit[32]      writeback_data;
 } t_reve_r_coproc_response;
 
 /*m reve_r_muldiv */
@@ -55,3 +61,65 @@ extern module reve_r_muldiv( clock clk,
     timing to   rising clock clk coproc_controls, riscv_config;
     timing from rising clock clk coproc_response;
 }
+
+/*m reve_r_muldiv_fast_mul
+ *
+ * reve_r_muldiv with a single-cycle multiplier
+ */
+extern module reve_r_muldiv_fast_mul( clock clk,
+                                      input bit reset_n,
+                                      input t_reve_r_coproc_controls  coproc_controls,
+                                      output t_reve_r_coproc_response coproc_response,
+                                      input t_reve_r_config riscv_config
+)
+{
+    timing to   rising clock clk coproc_controls, riscv_config;
+    timing from rising clock clk coproc_response;
+}
+
+/*m reve_r_muldiv_div_radix4
+ *
+ * reve_r_muldiv with a divider that produces two quotient bits per cycle
+ */
+extern module reve_r_muldiv_div_radix4( clock clk,
+                                        input bit reset_n,
+                                        input t_reve_r_coproc_controls  coproc_controls,
+                                        output t_reve_r_coproc_response coproc_response,
+                                        input t_reve_r_config riscv_config
+)
+{
+    timing to   rising clock clk coproc_controls, riscv_config;
+    timing from rising clock clk coproc_response;
+}
+
+/*m reve_r_clmul
+ *
+ * Carry-less multiply (Zbc) coprocessor; its response is zero except
+ * for carry-less multiplies, so it may be ORed with that of reve_r_muldiv
+ */
+extern module reve_r_clmul( clock clk,
+                            input bit reset_n,
+                            input t_reve_r_coproc_controls  coproc_controls,
+                            output t_reve_r_coproc_response coproc_response,
+                            input t_reve_r_config riscv_config
+)
+{
+    timing to   rising clock clk coproc_controls, riscv_config;
+    timing from rising clock clk coproc_response;
+}
+
+/*m reve_r_pmul
+ *
+ * Packed SIMD dual multiply (kmda, kmxda) coprocessor; its response is
+ * zero except for those, so it may be ORed with that of reve_r_muldiv
+ */
+extern module reve_r_pmul( clock clk,
+                           input bit reset_n,
+                           input t_reve_r_coproc_controls  coproc_controls,
+                           output t_reve_r_coproc_response coproc_response,
+                           input t_reve_r_config riscv_config
+)
+{
+    timing to   rising clock clk coproc_controls, riscv_config;
+    timing from rising clock clk coproc_response;
+}
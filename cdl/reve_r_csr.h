@@ -50,6 +50,7 @@ typedef struct {
 typedef struct {
     t_reve_r_mode exec_mode "Mode of instruction in the execution stage";
     bit retire;
+    bit retire_pair "Asserted with retire if a second instruction retires in the same cycle (dual-issue pipelines, or a folded jump)";
     bit[64] timer_value;
     t_reve_r_i32_trap trap;
 } t_reve_r_csr_controls;
@@ -72,6 +72,8 @@ typedef enum[4] {
     reve_r_subop_srla   = 5,    // => subop shift
     reve_r_subop_or     = 6,
     reve_r_subop_and    = 7,
+    reve_r_subop_bitmanip = 9,  // => bitmanip_op
+    reve_r_subop_packed   = 10, // => packed_op, packed_bytes
 
     reve_r_subop_mull     = 0, // same as reve_r_op_f3
     reve_r_subop_mulhss   = 1,
@@ -128,6 +130,54 @@ typedef enum[4] {
     reve_r_shift_op_mask_right           = 4b0100 // used to determine if shift amount to  be negated
 } t_reve_r_shift_op;
 
+/*t t_reve_r_bitmanip_op - ratified bit manipulation (Zba, Zbb, Zbc, Zbs) operations that are not shifts or rotates */
+typedef enum[5] {
+    reve_r_bitmanip_op_shadd,  // Zba sh1add/sh2add/sh3add, with the shift in immediate_shift
+    reve_r_bitmanip_op_andn,   // Zbb
+    reve_r_bitmanip_op_orn,
+    reve_r_bitmanip_op_xnor,
+    reve_r_bitmanip_op_min,
+    reve_r_bitmanip_op_minu,
+    reve_r_bitmanip_op_max,
+    reve_r_bitmanip_op_maxu,
+    reve_r_bitmanip_op_clz,
+    reve_r_bitmanip_op_ctz,
+    reve_r_bitmanip_op_cpop,
+    reve_r_bitmanip_op_sext_b,
+    reve_r_bitmanip_op_sext_h,
+    reve_r_bitmanip_op_orc_b,
+    reve_r_bitmanip_op_bset,   // Zbs, with the bit number in rs2 or immediate_shift
+    reve_r_bitmanip_op_bclr,
+    reve_r_bitmanip_op_binv,
+    reve_r_bitmanip_op_bext,
+    reve_r_bitmanip_op_clmul,  // Zbc, performed by a carry-less multiply coprocessor
+    reve_r_bitmanip_op_clmulh,
+    reve_r_bitmanip_op_clmulr
+} t_reve_r_bitmanip_op;
+
+/*t t_reve_r_packed_op - packed SIMD (draft P subset) operations, on each 8-bit or 16-bit element */
+typedef enum[4] {
+    reve_r_packed_op_add,     // add8, add16 - wrapping
+    reve_r_packed_op_sub,     // sub8, sub16
+    reve_r_packed_op_kadd,    // kadd8, kadd16 - signed saturating
+    reve_r_packed_op_ksub,
+    reve_r_packed_op_ukadd,   // ukadd8, ukadd16 - unsigned saturating
+    reve_r_packed_op_uksub,
+    reve_r_packed_op_cmpeq,   // element is all ones if true, zero if false
+    reve_r_packed_op_scmplt,
+    reve_r_packed_op_scmple,
+    reve_r_packed_op_ucmplt,
+    reve_r_packed_op_ucmple,
+    reve_r_packed_op_smin,
+    reve_r_packed_op_smax,
+    reve_r_packed_op_umin,
+    reve_r_packed_op_umax,
+    reve_r_packed_op_sra,     // sra8, sra16 - by rs2[3;0] (or rs2[4;0] for 16-bit elements)
+    reve_r_packed_op_srl,
+    reve_r_packed_op_sll,
+    reve_r_packed_op_kmda     // kmda, kmxda (16-bit only, kmxda has funct7[0] set) - performed by a packed multiply coprocessor
+} t_reve_r_packed_op;
+
 /*t t_reve_r_inst_debug_op
  */
 typedef enum[2] {
@@ -177,9 +227,14 @@ typedef struct {
     t_reve_r_op     op                  "Operation class of the instruction";
     t_reve_r_subop  subop               "Subclass of the operation class";
     t_reve_r_shift_op shift_op          "Only valid for shift operations (i.e. ignored if op is not alu and subop is not a shift)";
-    bit[7]         funct7              "Options for subop only to be used by custom instructions (so it can be optimized out)";
+    t_reve_r_bitmanip_op bitmanip_op    "Only valid for bit manipulation operations (i.e. ignored if op is not alu and subop is not bitmanip)";
+    t_reve_r_packed_op packed_op        "Only valid for packed SIMD operations (i.e. ignored if op is not alu and subop is not packed)";
+    bit            packed_bytes        "Only valid for packed SIMD operations; asserted for 8-bit elements, clear for 16-bit elements";
+    bit[7]         funct7              "Options for subop only to be used by custom instructions (so it can be optimized out), for atomics (funct5, aq, rl), and by packed multiply coprocessors";
     bit           illegal              "asserted if an illegal opcode";
     bit           is_compressed        "asserted if from an reve_r-c decode, clear otherwise (effects link register)";
+    bit           fused                "asserted if the decode of a fused pair of instructions from reve_r_i32_fuse (effects link register)";
+    bit           fused_compressed     "asserted if fused and the second instruction of the pair is from an reve_r-c decode";
     t_reve_r_decode_ext ext         "extended decode, not used by the main pipeline";
 } t_reve_r_decode;
 
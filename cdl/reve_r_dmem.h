@@ -47,6 +47,7 @@ typedef struct {
  *
  * Responses can include an error indication?
  * Responses for atomics are the original read data, or the result of an 'store conditional'
+ * (0 if the store was performed, 1 if it was not)
  *
  * Note that the response in some circumstances is defined to be valid in the same cycle as the request.
  * In other circumstances it is defined to be valid in the cycle following a request.
@@ -79,3 +80,17 @@ typedef struct {
     bit[32]              read_data         "Data returned from reading the requested address";
 } t_reve_r_dmem_access_resp;
 
+/*m reve_r_dmem_atomic
+ *
+ * Data to write back for an atomic memory operation, for a memory
+ * controller that supports atomics
+ */
+extern module reve_r_dmem_atomic( input t_reve_r_dmem_access_req_type req_type,
+                                  input bit[32]  read_data,
+                                  input bit[32]  operand,
+                                  output bit[32] write_data
+    )
+{
+    timing comb input  req_type, read_data, operand;
+    timing comb output write_data;
+}
@@ -0,0 +1,57 @@
+/** @copyright (C) 2016-2020,  Gavin J Stark.  All rights reserved.
+ *
+ * @copyright
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0.
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ * @file   reve_r_dmem_modules.h
+ * @brief  Modules that sit on the Reve-R data memory access interface
+ *
+ */
+
+/*a Includes */
+include "reve_r.h"
+include "reve_r_dmem.h"  // for data memory access request/response
+include "reve_r_burst.h" // for cache burst request/response
+
+/*a Implementations */
+/*m reve_r_dcache
+ */
+extern module reve_r_dcache( clock clk,
+                             input bit reset_n,
+                             input t_reve_r_dmem_access_req   dmem_access_req,
+                             output t_reve_r_dmem_access_resp dmem_access_resp,
+                             output t_reve_r_burst_req        burst_req,
+                             input t_reve_r_burst_resp        burst_resp,
+                             input bit                        clean,
+                             input bit                        invalidate,
+                             output bit                       maintenance_busy
+    )
+{
+    timing to   rising clock clk dmem_access_req, burst_resp, clean, invalidate;
+    timing from rising clock clk dmem_access_resp, burst_req, maintenance_busy;
+}
+
+/*m reve_r_dcache_write_through
+ */
+extern module reve_r_dcache_write_through( clock clk,
+                                           input bit reset_n,
+                                           input t_reve_r_dmem_access_req   dmem_access_req,
+                                           output t_reve_r_dmem_access_resp dmem_access_resp,
+                                           output t_reve_r_burst_req        burst_req,
+                                           input t_reve_r_burst_resp        burst_resp,
+                                           input bit                        clean,
+                                           input bit                        invalidate,
+                                           output bit                       maintenance_busy
+    )
+{
+    timing to   rising clock clk dmem_access_req, burst_resp, clean, invalidate;
+    timing from rising clock clk dmem_access_resp, burst_req, maintenance_busy;
+}
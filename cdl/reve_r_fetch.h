@@ -10,6 +10,8 @@ typedef enum[3] {
     rv_fetch_sequential_32  = 3b010, // address=+4 from last cycle
     rv_fetch_repeat         = 3b011, // address will be same as last cycle
     rv_fetch_sequential_16  = 3b110, // address=+2 from last cycle
+    rv_fetch_sequential_48  = 3b101, // address=+6 from last cycle - after a dual-issue pair only
+    rv_fetch_sequential_64  = 3b111, // address=+8 from last cycle - after a dual-issue pair only
 } t_reve_r_fetch_req_type;
 
 /*t t_reve_r_fetch_req
@@ -36,3 +38,63 @@ typedef struct {
     bit[2]   error "One bit per 16-bits of the data";
 } t_reve_r_fetch_resp;
 
+/*t t_reve_r_fetch_resp_dual
+ *
+ * Response to a fetch request for a dual-issue pipeline; this is the
+ * fetch response with the 32 bits that follow the data, so that the
+ * instruction after the one fetched may be decoded too
+ *
+ */
+typedef struct {
+    bit      valid;
+    bit[32]  data;
+    bit[2]   error           "One bit per 16-bits of the data";
+    bit[2]   following_valid "One bit per 16-bits of the following data; a half-word with an error is not valid";
+    bit[32]  following_data  "The 32 bits following the data";
+} t_reve_r_fetch_resp_dual;
+
+/*t t_reve_r_fetch64_req
+ *
+ * Request from a fetch buffer to an instruction memory that is 64 bits
+ * wide; as with the fetch request, the response is required in the
+ * same cycle
+ *
+ */
+typedef struct {
+    bit      valid    "Asserted if a doubleword is requested";
+    bit[32]  address  "Doubleword-aligned address to fetch";
+    t_reve_r_mode mode "Mode of the fetch";
+} t_reve_r_fetch64_req;
+
+/*t t_reve_r_fetch64_resp
+ */
+typedef struct {
+    bit      valid;
+    bit[64]  data;
+    bit[4]   error "One bit per 16-bits of the data";
+} t_reve_r_fetch64_resp;
+
+/*t t_reve_r_prefetch_req
+ *
+ * Request from a prefetch queue to an instruction memory; requests
+ * are for word-aligned 32-bit words, and may be pipelined
+ *
+ */
+typedef struct {
+    bit      valid    "Asserted if a word is requested; the request is taken if the response ack is asserted";
+    bit[32]  address  "Word-aligned address to fetch";
+    t_reve_r_mode mode "Mode of the fetch";
+} t_reve_r_prefetch_req;
+
+/*t t_reve_r_prefetch_resp
+ *
+ * Response from an instruction memory to a prefetch queue; read data
+ * is returned in the order that requests were taken, with any latency
+ *
+ */
+typedef struct {
+    bit      ack      "Asserted if a valid request is taken in this cycle";
+    bit      valid    "Asserted if data and error are valid for the oldest outstanding request";
+    bit[32]  data     "Data read";
+    bit      error    "Asserted if the read of the word failed";
+} t_reve_r_prefetch_resp;
@@ -0,0 +1,76 @@
+/** @copyright (C) 2016-2020,  Gavin J Stark.  All rights reserved.
+ *
+ * @copyright
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0.
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ * @file   reve_r_fetch_modules.h
+ * @brief  Modules that sit on the Reve-R instruction fetch interface
+ *
+ */
+
+/*a Includes */
+include "reve_r.h"
+include "reve_r_fetch.h" // for fetch request/response
+include "reve_r_burst.h" // for cache burst request/response
+
+/*a Implementations */
+/*m reve_r_loop_buffer
+ */
+extern module reve_r_loop_buffer( clock clk,
+                                  input bit reset_n,
+                                  input t_reve_r_fetch_req   fetch_req,
+                                  input t_reve_r_fetch_resp  fetch_resp,
+                                  input bit                  write_valid,
+                                  input bit[32]              write_address,
+                                  input bit                  invalidate,
+                                  output bit                 loop_buffer_hit,
+                                  output t_reve_r_fetch_resp loop_buffer_resp
+    )
+{
+    timing to   rising clock clk fetch_req, fetch_resp, write_valid, write_address, invalidate;
+    timing from rising clock clk loop_buffer_hit, loop_buffer_resp;
+    timing comb input fetch_req;
+    timing comb output loop_buffer_hit, loop_buffer_resp;
+}
+
+/*m reve_r_prefetch_queue
+ */
+extern module reve_r_prefetch_queue( clock clk,
+                                     input bit reset_n,
+                                     input t_reve_r_fetch_req      fetch_req,
+                                     output t_reve_r_fetch_resp    fetch_resp,
+                                     output t_reve_r_prefetch_req  prefetch_req,
+                                     input t_reve_r_prefetch_resp  prefetch_resp,
+                                     input bit                     invalidate
+    )
+{
+    timing to   rising clock clk fetch_req, prefetch_resp, invalidate;
+    timing from rising clock clk fetch_resp, prefetch_req;
+    timing comb input fetch_req, prefetch_resp, invalidate;
+    timing comb output fetch_resp, prefetch_req;
+}
+
+/*m reve_r_icache
+ */
+extern module reve_r_icache( clock clk,
+                             input bit reset_n,
+                             input t_reve_r_fetch_req   fetch_req,
+                             output t_reve_r_fetch_resp fetch_resp,
+                             output t_reve_r_burst_req  burst_req,
+                             input t_reve_r_burst_resp  burst_resp,
+                             input bit                  invalidate
+    )
+{
+    timing to   rising clock clk fetch_req, burst_resp, invalidate;
+    timing from rising clock clk fetch_resp, burst_req;
+    timing comb input fetch_req;
+    timing comb output fetch_resp;
+}
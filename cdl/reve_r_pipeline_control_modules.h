@@ -59,14 +59,151 @@ extern module reve_r_pipeline_control( clock clk,
  */
 extern module reve_r_pipeline_control_fetch_req( input t_reve_r_pipeline_state        pipeline_state,
                                                     input t_reve_r_pipeline_response     pipeline_response,
+                                                    input t_reve_r_pipeline_branch_predict branch_predict,
                                                     output t_reve_r_pipeline_fetch_req   pipeline_fetch_req,
                                                     output t_reve_r_fetch_req            ifetch_req
 )
 {
-    timing comb input pipeline_state, pipeline_response;
+    timing comb input pipeline_state, pipeline_response, branch_predict;
     timing comb output ifetch_req, pipeline_fetch_req;
 }
 
+/*m reve_r_pipeline_control_branch_predictor
+ */
+extern module reve_r_pipeline_control_branch_predictor( clock clk,
+                                                           input bit reset_n,
+                                                           input t_reve_r_pipeline_state           pipeline_state,
+                                                           input t_reve_r_pipeline_response        pipeline_response,
+                                                           input t_reve_r_pipeline_control         pipeline_control,
+                                                           input t_reve_r_fetch_req                ifetch_req,
+                                                           output t_reve_r_pipeline_branch_predict branch_predict
+)
+{
+    timing to   rising clock clk pipeline_state, pipeline_response, pipeline_control, ifetch_req;
+    timing from rising clock clk branch_predict;
+    timing comb input pipeline_state, pipeline_response;
+    timing comb output branch_predict;
+}
+
+/*m reve_r_pipeline_control_branch_predictor_bht64 - reve_r_pipeline_control_branch_predictor with a 64-entry branch history table
+ */
+extern module reve_r_pipeline_control_branch_predictor_bht64( clock clk,
+                                                                 input bit reset_n,
+                                                                 input t_reve_r_pipeline_state           pipeline_state,
+                                                                 input t_reve_r_pipeline_response        pipeline_response,
+                                                                 input t_reve_r_pipeline_control         pipeline_control,
+                                                                 input t_reve_r_fetch_req                ifetch_req,
+                                                                 output t_reve_r_pipeline_branch_predict branch_predict
+)
+{
+    timing to   rising clock clk pipeline_state, pipeline_response, pipeline_control, ifetch_req;
+    timing from rising clock clk branch_predict;
+    timing comb input pipeline_state, pipeline_response;
+    timing comb output branch_predict;
+}
+
+/*m reve_r_pipeline_control_branch_predictor_bht1024 - reve_r_pipeline_control_branch_predictor with a 1024-entry branch history table
+ */
+extern module reve_r_pipeline_control_branch_predictor_bht1024( clock clk,
+                                                                   input bit reset_n,
+                                                                   input t_reve_r_pipeline_state           pipeline_state,
+                                                                   input t_reve_r_pipeline_response        pipeline_response,
+                                                                   input t_reve_r_pipeline_control         pipeline_control,
+                                                                   input t_reve_r_fetch_req                ifetch_req,
+                                                                   output t_reve_r_pipeline_branch_predict branch_predict
+)
+{
+    timing to   rising clock clk pipeline_state, pipeline_response, pipeline_control, ifetch_req;
+    timing from rising clock clk branch_predict;
+    timing comb input pipeline_state, pipeline_response;
+    timing comb output branch_predict;
+}
+
+/*m reve_r_pipeline_control_branch_predictor_gshare - reve_r_pipeline_control_branch_predictor with a 1024-entry gshare branch history table
+ */
+extern module reve_r_pipeline_control_branch_predictor_gshare( clock clk,
+                                                                  input bit reset_n,
+                                                                  input t_reve_r_pipeline_state           pipeline_state,
+                                                                  input t_reve_r_pipeline_response        pipeline_response,
+                                                                  input t_reve_r_pipeline_control         pipeline_control,
+                                                                  input t_reve_r_fetch_req                ifetch_req,
+                                                                  output t_reve_r_pipeline_branch_predict branch_predict
+)
+{
+    timing to   rising clock clk pipeline_state, pipeline_response, pipeline_control, ifetch_req;
+    timing from rising clock clk branch_predict;
+    timing comb input pipeline_state, pipeline_response;
+    timing comb output branch_predict;
+}
+
+/*m reve_r_pipeline_control_branch_predictor_fold - reve_r_pipeline_control_branch_predictor with jump folding
+ */
+extern module reve_r_pipeline_control_branch_predictor_fold( clock clk,
+                                                                input bit reset_n,
+                                                                input t_reve_r_pipeline_state           pipeline_state,
+                                                                input t_reve_r_pipeline_response        pipeline_response,
+                                                                input t_reve_r_pipeline_control         pipeline_control,
+                                                                input t_reve_r_fetch_req                ifetch_req,
+                                                                output t_reve_r_pipeline_branch_predict branch_predict
+)
+{
+    timing to   rising clock clk pipeline_state, pipeline_response, pipeline_control, ifetch_req;
+    timing from rising clock clk branch_predict;
+    timing comb input pipeline_state, pipeline_response;
+    timing comb output branch_predict;
+}
+
+/*m reve_r_pipeline_control_branch_predictor_btb - reve_r_pipeline_control_branch_predictor with a branch target buffer
+ */
+extern module reve_r_pipeline_control_branch_predictor_btb( clock clk,
+                                                               input bit reset_n,
+                                                               input t_reve_r_pipeline_state           pipeline_state,
+                                                               input t_reve_r_pipeline_response        pipeline_response,
+                                                               input t_reve_r_pipeline_control         pipeline_control,
+                                                               input t_reve_r_fetch_req                ifetch_req,
+                                                               output t_reve_r_pipeline_branch_predict branch_predict
+)
+{
+    timing to   rising clock clk pipeline_state, pipeline_response, pipeline_control, ifetch_req;
+    timing from rising clock clk branch_predict;
+    timing comb input pipeline_state, pipeline_response;
+    timing comb output branch_predict;
+}
+
+/*m reve_r_pipeline_control_branch_predictor_ras - reve_r_pipeline_control_branch_predictor with a return address stack
+ */
+extern module reve_r_pipeline_control_branch_predictor_ras( clock clk,
+                                                               input bit reset_n,
+                                                               input t_reve_r_pipeline_state           pipeline_state,
+                                                               input t_reve_r_pipeline_response        pipeline_response,
+                                                               input t_reve_r_pipeline_control         pipeline_control,
+                                                               input t_reve_r_fetch_req                ifetch_req,
+                                                               output t_reve_r_pipeline_branch_predict branch_predict
+)
+{
+    timing to   rising clock clk pipeline_state, pipeline_response, pipeline_control, ifetch_req;
+    timing from rising clock clk branch_predict;
+    timing comb input pipeline_state, pipeline_response;
+    timing comb output branch_predict;
+}
+
+/*m reve_r_pipeline_control_fetch_buffer
+ */
+extern module reve_r_pipeline_control_fetch_buffer( clock clk,
+                                                       input bit reset_n,
+                                                       input t_reve_r_fetch_req      ifetch_req,
+                                                       output t_reve_r_fetch_resp    ifetch_resp,
+                                                       input bit                     invalidate,
+                                                       output t_reve_r_fetch64_req   fetch64_req,
+                                                       input t_reve_r_fetch64_resp   fetch64_resp
+)
+{
+    timing to   rising clock clk ifetch_req, invalidate, fetch64_resp;
+    timing from rising clock clk ifetch_resp, fetch64_req;
+    timing comb input ifetch_req, invalidate, fetch64_resp;
+    timing comb output ifetch_resp, fetch64_req;
+}
+
 /*m reve_r_pipeline_control_fetch_data
  */
 extern module reve_r_pipeline_control_fetch_data( input t_reve_r_pipeline_state   pipeline_state,
@@ -80,6 +217,19 @@ extern module reve_r_pipeline_control_fetch_data( input t_reve_r_pipeline_state
     timing comb output pipeline_fetch_data;
 }
 
+/*m reve_r_pipeline_control_fetch_data_dual
+ */
+extern module reve_r_pipeline_control_fetch_data_dual( input t_reve_r_pipeline_state   pipeline_state,
+                                                          input t_reve_r_fetch_req          ifetch_req,
+                                                          input t_reve_r_fetch_resp_dual    ifetch_resp,
+                                                          input t_reve_r_pipeline_fetch_req   pipeline_fetch_req,
+                                                          output t_reve_r_pipeline_fetch_data pipeline_fetch_data
+)
+{
+    timing comb input pipeline_state, ifetch_req, ifetch_resp, pipeline_fetch_req;
+    timing comb output pipeline_fetch_data;
+}
+
 /*m reve_r_pipeline_trap_interposer
  */
 extern module reve_r_pipeline_trap_interposer( input  t_reve_r_pipeline_state   pipeline_state,
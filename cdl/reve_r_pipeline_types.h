@@ -51,6 +51,7 @@ typedef struct {
     t_reve_r_mode interrupt_to_mode "If interrupt then this is the mode that whose pp/pie/epc should be set from current mode's";
     bit[32]           instruction_data;
     t_reve_r_inst_debug instruction_debug;
+    bit    single_step             "Asserted if dcsr.step is set, so every instruction must enter the exec stage (no jump folding)";
 } t_reve_r_pipeline_state;
 
 /*t t_reve_r_pipeline_control_decode - late in clock cycle to affect clocking
@@ -108,6 +109,12 @@ typedef struct {
     bit[32]  branch_target     "Used if predict_branch";
     t_reve_r_decode idecode "Decode of instruction (if valid)";
     bit enable_branch_prediction "Asserted if branch prediction (and hence branch_target) is to be used";
+    bit branch_resolved "Asserted if the decode stage conditional branch has been resolved in decode, so branch_taken is not a prediction";
+    bit branch_taken    "Asserted if the decode stage conditional branch is resolved as taken; valid only if branch_resolved";
+    bit jalr_target_valid "Asserted if the decode stage JALR target has been calculated in decode";
+    bit[32] jalr_target   "Target of the decode stage JALR; valid only if jalr_target_valid";
+    bit paired             "Asserted (by a dual-issue pipeline only) if the instruction following the decode stage instruction is issued with it, so fetch continues after both";
+    bit pair_is_compressed "Asserted if the paired instruction is compressed; valid only if paired";
 } t_reve_r_pipeline_response_decode;
 
 /*t t_reve_r_pipeline_response_exec
@@ -118,6 +125,7 @@ typedef struct {
     bit first_cycle     "Asserted if first clock cycles of exec stage; not changed if pipeline control indicates a cycle cannot complete";
     bit last_cycle      "Asserted if no more clock cycles after this (if not blocked) are required to complete the exec stage";
     bit interrupt_block "In standard pipelines this must be low; it blocks interrupts";
+    bit paired          "Asserted (by a dual-issue pipeline only) if a second, sequential, ALU instruction is executing with this one; it retires with this one, and is flushed with it";
     t_reve_r_inst instruction;
     t_reve_r_decode idecode "Decode of instruction (if valid)";
     bit[32] rs1;
@@ -125,6 +133,7 @@ typedef struct {
     bit[32]  pc              "Actual PC of execution instruction";
     bit          predicted_branch   "From pipeline_fetch_data associated with the decode of this instruction";
     bit[32] pc_if_mispredicted "From pipeline_fetch_data associated with the decode of this instruction";
+    bit          folded_jump        "From pipeline_fetch_data associated with the decode of this instruction; a folded 'j' retires with this instruction unless it branches";
     bit branch_condition_met;
     t_reve_r_dmem_access_req dmem_access_req;
     t_reve_r_csr_access     csr_access;
@@ -156,6 +165,7 @@ typedef struct {
     t_reve_r_pipeline_response_mem    mem;
     t_reve_r_pipeline_response_rfw    rfw;
     bit                              pipeline_empty;
+    bit                              coproc_late_writeback "Asserted if the pipeline has a register scoreboard, so coprocessor results may be written back after the instruction retires";
 } t_reve_r_pipeline_response;
 
 /*t t_reve_r_pipeline_trap_request
@@ -179,9 +189,24 @@ typedef struct {
 typedef struct {
     bit      debug_fetch            "Asserted if fetch of a debug location (data0 or ebreak)";
     bit     predicted_branch   "Only used if branch prediction is supported - so not for single cycle pipeline; for internal use really";
-    bit[32] pc_if_mispredicted "Only used if branch prediction is supported - so not for single cycle pipeline for internal use really";
+    bit[32] pc_if_mispredicted "Only used if branch prediction is supported - so not for single cycle pipeline for internal use really; for a predicted JALR this is the predicted target";
+    bit     folded_jump        "Asserted if the 'j' following the decode stage instruction is folded, and so retires with it";
 } t_reve_r_pipeline_fetch_req;
 
+/*t t_reve_r_pipeline_branch_predict
+  From the branch predictor, early in the cycle, to the fetch request
+ */
+typedef struct {
+    bit     dec_predict_valid "Asserted if the branch predictor has a dynamic prediction for a conditional branch in the decode stage";
+    bit     dec_predict_taken "Asserted if the dynamic prediction is that the decode stage conditional branch is taken";
+    bit     fetch_btb_hit     "Asserted if the branch target buffer holds a predicted-taken branch at the decode stage PC, looked up when it was fetched";
+    bit[32] fetch_btb_target  "Target of the branch at the decode stage PC, if fetch_btb_hit";
+    bit     dec_return_valid  "Asserted if the decode stage instruction is a JALR return with a target from the return address stack";
+    bit[32] dec_return_target "Predicted target of the decode stage JALR return, if dec_return_valid";
+    bit     dec_fold_valid    "Asserted if the decode stage instruction is followed by a 'j' (JAL to x0) that may be folded";
+    bit[32] dec_fold_target   "Target of the 'j' following the decode stage instruction, if dec_fold_valid";
+} t_reve_r_pipeline_branch_predict;
+
 /*t t_reve_r_pipeline_fetch_data
  */
 typedef struct {
@@ -191,6 +216,9 @@ typedef struct {
     t_reve_r_inst instruction;
     bit          dec_predicted_branch   "Not part of fetch - indicates that pipeline_control predicted a branch for the decode, so when the decode is executed this should match the execution - if not, a mispredict occurs";
     bit[32] dec_pc_if_mispredicted;
+    bit          dec_folded_jump        "Not part of fetch - indicates that pipeline_control folded a 'j' following the decode, so it retires with the decode";
+    bit[2]  following_valid "One bit per 16-bits of following; only used by a dual-issue pipeline, and zero otherwise";
+    bit[32] following       "The 32 bits following the instruction, for a dual-issue pipeline to decode a second instruction";
 } t_reve_r_pipeline_fetch_data;
 
 /*t t_reve_r_pipeline_debug_control
@@ -67,3 +67,172 @@ module reve_r_pipeline_d_e_m_w( clock clk,
     timing comb output pipeline_response;
 }
 
+/*m reve_r_pipeline_d_e_m_w_scoreboard - reve_r_pipeline_d_e_m_w with a coprocessor scoreboard for late writeback
+ */
+extern
+module reve_r_pipeline_d_e_m_w_scoreboard( clock clk,
+                                           input bit reset_n,
+                                           input t_reve_r_pipeline_control     pipeline_control,
+                                           output t_reve_r_pipeline_response   pipeline_response,
+                                           input t_reve_r_pipeline_fetch_data  pipeline_fetch_data,
+                                           input  t_reve_r_dmem_access_resp dmem_access_resp,
+                                           input t_reve_r_coproc_response   coproc_response,
+                                           input bit[32]                 csr_read_data,
+                                           input  t_reve_r_config          riscv_config
+)
+{
+    timing from rising clock clk pipeline_response;
+    timing to   rising clock clk dmem_access_resp, pipeline_control, pipeline_fetch_data, coproc_response, csr_read_data;
+    timing to   rising clock clk riscv_config;
+    timing comb input riscv_config;
+    timing comb output pipeline_response;
+}
+
+/*m reve_r_pipeline_d_e_m_w_load_forward - reve_r_pipeline_d_e_m_w with load-use forwarding from the memory stage to the ALU
+ */
+extern
+module reve_r_pipeline_d_e_m_w_load_forward( clock clk,
+                                             input bit reset_n,
+                                             input t_reve_r_pipeline_control     pipeline_control,
+                                             output t_reve_r_pipeline_response   pipeline_response,
+                                             input t_reve_r_pipeline_fetch_data  pipeline_fetch_data,
+                                             input  t_reve_r_dmem_access_resp dmem_access_resp,
+                                             input t_reve_r_coproc_response   coproc_response,
+                                             input bit[32]                 csr_read_data,
+                                             input  t_reve_r_config          riscv_config
+)
+{
+    timing from rising clock clk pipeline_response;
+    timing to   rising clock clk dmem_access_resp, pipeline_control, pipeline_fetch_data, coproc_response, csr_read_data;
+    timing to   rising clock clk riscv_config;
+    timing comb input riscv_config;
+    timing comb output pipeline_response;
+}
+
+/*m reve_r_pipeline_d_e_m_w_load_store_forward - reve_r_pipeline_d_e_m_w with load-use forwarding from the memory stage to store data only
+ */
+extern
+module reve_r_pipeline_d_e_m_w_load_store_forward( clock clk,
+                                                   input bit reset_n,
+                                                   input t_reve_r_pipeline_control     pipeline_control,
+                                                   output t_reve_r_pipeline_response   pipeline_response,
+                                                   input t_reve_r_pipeline_fetch_data  pipeline_fetch_data,
+                                                   input  t_reve_r_dmem_access_resp dmem_access_resp,
+                                                   input t_reve_r_coproc_response   coproc_response,
+                                                   input bit[32]                 csr_read_data,
+                                                   input  t_reve_r_config          riscv_config
+)
+{
+    timing from rising clock clk pipeline_response;
+    timing to   rising clock clk dmem_access_resp, pipeline_control, pipeline_fetch_data, coproc_response, csr_read_data;
+    timing to   rising clock clk riscv_config;
+    timing comb input riscv_config;
+    timing comb output pipeline_response;
+}
+
+/*m reve_r_pipeline_d_e_m_w_load_registered - reve_r_pipeline_d_e_m_w with memory stage results registered into the ALU operands
+ */
+extern
+module reve_r_pipeline_d_e_m_w_load_registered( clock clk,
+                                                input bit reset_n,
+                                                input t_reve_r_pipeline_control     pipeline_control,
+                                                output t_reve_r_pipeline_response   pipeline_response,
+                                                input t_reve_r_pipeline_fetch_data  pipeline_fetch_data,
+                                                input  t_reve_r_dmem_access_resp dmem_access_resp,
+                                                input t_reve_r_coproc_response   coproc_response,
+                                                input bit[32]                 csr_read_data,
+                                                input  t_reve_r_config          riscv_config
+)
+{
+    timing from rising clock clk pipeline_response;
+    timing to   rising clock clk dmem_access_resp, pipeline_control, pipeline_fetch_data, coproc_response, csr_read_data;
+    timing to   rising clock clk riscv_config;
+    timing comb input riscv_config;
+    timing comb output pipeline_response;
+}
+
+/*m reve_r_pipeline_d_e_m_w_branch_resolve - reve_r_pipeline_d_e_m_w resolving conditional branches in decode when their operands are ready
+ */
+extern
+module reve_r_pipeline_d_e_m_w_branch_resolve( clock clk,
+                                               input bit reset_n,
+                                               input t_reve_r_pipeline_control     pipeline_control,
+                                               output t_reve_r_pipeline_response   pipeline_response,
+                                               input t_reve_r_pipeline_fetch_data  pipeline_fetch_data,
+                                               input  t_reve_r_dmem_access_resp dmem_access_resp,
+                                               input t_reve_r_coproc_response   coproc_response,
+                                               input bit[32]                 csr_read_data,
+                                               input  t_reve_r_config          riscv_config
+)
+{
+    timing from rising clock clk pipeline_response;
+    timing to   rising clock clk dmem_access_resp, pipeline_control, pipeline_fetch_data, coproc_response, csr_read_data;
+    timing to   rising clock clk riscv_config;
+    timing comb input riscv_config;
+    timing comb output pipeline_response;
+}
+
+/*m reve_r_pipeline_d_e_m_w_jalr_target - reve_r_pipeline_d_e_m_w calculating JALR targets in decode when rs1 is ready
+ */
+extern
+module reve_r_pipeline_d_e_m_w_jalr_target( clock clk,
+                                            input bit reset_n,
+                                            input t_reve_r_pipeline_control     pipeline_control,
+                                            output t_reve_r_pipeline_response   pipeline_response,
+                                            input t_reve_r_pipeline_fetch_data  pipeline_fetch_data,
+                                            input  t_reve_r_dmem_access_resp dmem_access_resp,
+                                            input t_reve_r_coproc_response   coproc_response,
+                                            input bit[32]                 csr_read_data,
+                                            input  t_reve_r_config          riscv_config
+)
+{
+    timing from rising clock clk pipeline_response;
+    timing to   rising clock clk dmem_access_resp, pipeline_control, pipeline_fetch_data, coproc_response, csr_read_data;
+    timing to   rising clock clk riscv_config;
+    timing comb input riscv_config;
+    timing comb output pipeline_response;
+}
+
+/*m reve_r_pipeline_dual
+ */
+extern
+module reve_r_pipeline_dual( clock clk,
+                             input bit reset_n,
+                             input t_reve_r_pipeline_state       pipeline_state,
+                             input t_reve_r_pipeline_control     pipeline_control,
+                             output t_reve_r_pipeline_response   pipeline_response,
+                             input t_reve_r_pipeline_fetch_data  pipeline_fetch_data,
+                             input  t_reve_r_dmem_access_resp dmem_access_resp,
+                             input t_reve_r_coproc_response   coproc_response,
+                             input bit[32]                 csr_read_data,
+                             input  t_reve_r_config          riscv_config
+)
+{
+    timing from rising clock clk pipeline_response;
+    timing to   rising clock clk dmem_access_resp, pipeline_state, pipeline_control, pipeline_fetch_data, coproc_response, csr_read_data;
+    timing to   rising clock clk riscv_config;
+    timing comb input riscv_config, pipeline_state;
+    timing comb output pipeline_response;
+}
+
+/*m reve_r_pipeline_dual_fused
+ */
+extern
+module reve_r_pipeline_dual_fused( clock clk,
+                                   input bit reset_n,
+                                   input t_reve_r_pipeline_state       pipeline_state,
+                                   input t_reve_r_pipeline_control     pipeline_control,
+                                   output t_reve_r_pipeline_response   pipeline_response,
+                                   input t_reve_r_pipeline_fetch_data  pipeline_fetch_data,
+                                   input  t_reve_r_dmem_access_resp dmem_access_resp,
+                                   input t_reve_r_coproc_response   coproc_response,
+                                   input bit[32]                 csr_read_data,
+                                   input  t_reve_r_config          riscv_config
+)
+{
+    timing from rising clock clk pipeline_response;
+    timing to   rising clock clk dmem_access_resp, pipeline_state, pipeline_control, pipeline_fetch_data, coproc_response, csr_read_data;
+    timing to   rising clock clk riscv_config;
+    timing comb input riscv_config, pipeline_state;
+    timing comb output pipeline_response;
+}
@@ -17,17 +17,17 @@
  */
 
 /*a Includes */
-include "types/apb.h"
-include "types/jtag.h"
-include "utils/jtag_modules.h"
-include "cpu/riscv/riscv.h"
-include "cpu/riscv/riscv_internal_types.h"
-include "srams.h"
+include "apb::apb.h"
+include "utils::sram_access.h"
+include "reve_r.h"
+include "reve_r_dmem.h"  // for data memory access request/response
+include "reve_r_debug.h" // for debug_mst/tgt
+include "reve_r_trace.h" // for trace
 
 /*a Implementations of CPUs with memories */
 /*m reve_r_subsystem_generic  - Generic Reve-r implementation with pipeline length of 2+
 
- reve_r_config should be HARDWIRED (not off registers) to force logic to be
+ riscv_config should be HARDWIRED (not off registers) to force logic to be
  discarded at synthesis
 
  alternatively submodules may be built with appropriate force's set to
@@ -37,17 +37,17 @@ extern
 module reve_r_subsystem_generic( clock clk,
                                  input bit reset_n,
                                  input bit proc_reset_n,
-                                 input t_riscv_irqs             irqs               "Interrupts in to the CPU",
-                                 output t_riscv_mem_access_req  data_access_req,
-                                 input  t_riscv_mem_access_resp data_access_resp,
+                                 input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                 output t_reve_r_dmem_access_req  data_access_req,
+                                 input  t_reve_r_dmem_access_resp data_access_resp,
                                  output t_apb_request           apb_request,
                                  input  t_apb_response          apb_response,
                                  input t_sram_access_req sram_access_req,
                                  output t_sram_access_resp sram_access_resp,
-                                 input  t_riscv_debug_mst               debug_mst,
-                                 output t_riscv_debug_tgt               debug_tgt,
-                                 input  t_riscv_config          riscv_config,
-                                 output t_riscv_i32_trace       trace
+                                 input  t_reve_r_debug_mst               debug_mst,
+                                 output t_reve_r_debug_tgt               debug_tgt,
+                                 input  t_reve_r_config          riscv_config,
+                                 output t_reve_r_trace           trace
     )
 {
     timing from rising clock clk apb_request;
@@ -90,17 +90,17 @@ extern
 module reve_r_subsystem_3( clock clk,
                                   input bit reset_n,
                                   input bit proc_reset_n,
-                                  input t_riscv_irqs             irqs               "Interrupts in to the CPU",
-                                  output t_riscv_mem_access_req  data_access_req,
-                                  input  t_riscv_mem_access_resp data_access_resp,
+                                  input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                  output t_reve_r_dmem_access_req  data_access_req,
+                                  input  t_reve_r_dmem_access_resp data_access_resp,
                                   output t_apb_request           apb_request,
                                   input  t_apb_response          apb_response,
                                   input t_sram_access_req sram_access_req,
                                   output t_sram_access_resp sram_access_resp,
-                                  input  t_riscv_debug_mst               debug_mst,
-                                  output t_riscv_debug_tgt               debug_tgt,
-                                  input  t_riscv_config          riscv_config,
-                                  output t_riscv_i32_trace       trace
+                                  input  t_reve_r_debug_mst               debug_mst,
+                                  output t_reve_r_debug_tgt               debug_tgt,
+                                  input  t_reve_r_config          riscv_config,
+                                  output t_reve_r_trace           trace
     )
 {
     timing from rising clock clk apb_request;
@@ -133,17 +133,98 @@ extern
 module reve_r_subsystem_5( clock clk,
                                   input bit reset_n,
                                   input bit proc_reset_n,
-                                  input t_riscv_irqs             irqs               "Interrupts in to the CPU",
-                                  output t_riscv_mem_access_req  data_access_req,
-                                  input  t_riscv_mem_access_resp data_access_resp,
+                                  input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                  output t_reve_r_dmem_access_req  data_access_req,
+                                  input  t_reve_r_dmem_access_resp data_access_resp,
                                   output t_apb_request           apb_request,
                                   input  t_apb_response          apb_response,
                                   input t_sram_access_req sram_access_req,
                                   output t_sram_access_resp sram_access_resp,
-                                  input  t_riscv_debug_mst               debug_mst,
-                                  output t_riscv_debug_tgt               debug_tgt,
-                                  input  t_riscv_config          riscv_config,
-                                  output t_riscv_i32_trace       trace
+                                  input  t_reve_r_debug_mst               debug_mst,
+                                  output t_reve_r_debug_tgt               debug_tgt,
+                                  input  t_reve_r_config          riscv_config,
+                                  output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_zbc - reve_r_subsystem_5 with the carry-less multiply coprocessor
+
+ Built from reve_r_subsystem_5 with subsystem_clmul_enable set; the Zbc
+ instructions are decoded if riscv_config.i32_zbc is set.
+*/
+extern
+module reve_r_subsystem_5_zbc( clock clk,
+                                      input bit reset_n,
+                                      input bit proc_reset_n,
+                                      input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                      output t_reve_r_dmem_access_req  data_access_req,
+                                      input  t_reve_r_dmem_access_resp data_access_resp,
+                                      output t_apb_request           apb_request,
+                                      input  t_apb_response          apb_response,
+                                      input t_sram_access_req sram_access_req,
+                                      output t_sram_access_resp sram_access_resp,
+                                      input  t_reve_r_debug_mst               debug_mst,
+                                      output t_reve_r_debug_tgt               debug_tgt,
+                                      input  t_reve_r_config          riscv_config,
+                                      output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_pmul - reve_r_subsystem_5 with the packed SIMD multiply coprocessor
+
+ Built from reve_r_subsystem_5 with subsystem_pmul_enable set; the
+ packed SIMD dual multiplies are decoded if riscv_config.i32p and
+ riscv_config.i32p_mul are set.
+*/
+extern
+module reve_r_subsystem_5_pmul( clock clk,
+                                       input bit reset_n,
+                                       input bit proc_reset_n,
+                                       input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                       output t_reve_r_dmem_access_req  data_access_req,
+                                       input  t_reve_r_dmem_access_resp data_access_resp,
+                                       output t_apb_request           apb_request,
+                                       input  t_apb_response          apb_response,
+                                       input t_sram_access_req sram_access_req,
+                                       output t_sram_access_resp sram_access_resp,
+                                       input  t_reve_r_debug_mst               debug_mst,
+                                       output t_reve_r_debug_tgt               debug_tgt,
+                                       input  t_reve_r_config          riscv_config,
+                                       output t_reve_r_trace           trace
     )
 {
     timing from rising clock clk apb_request;
@@ -164,3 +245,747 @@ module reve_r_subsystem_5( clock clk,
     timing comb output debug_tgt;
 }
 
+/*m reve_r_subsystem_3_loop_buffer - reve_r_subsystem_3 with the loop buffer enabled
+
+ Built from reve_r_subsystem_3 with rv_cfg_loop_buffer_enable set.
+*/
+extern
+module reve_r_subsystem_3_loop_buffer( clock clk,
+                                              input bit reset_n,
+                                              input bit proc_reset_n,
+                                              input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                              output t_reve_r_dmem_access_req  data_access_req,
+                                              input  t_reve_r_dmem_access_resp data_access_resp,
+                                              output t_apb_request           apb_request,
+                                              input  t_apb_response          apb_response,
+                                              input t_sram_access_req sram_access_req,
+                                              output t_sram_access_resp sram_access_resp,
+                                              input  t_reve_r_debug_mst               debug_mst,
+                                              output t_reve_r_debug_tgt               debug_tgt,
+                                              input  t_reve_r_config          riscv_config,
+                                              output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_3_fetch64 - reve_r_subsystem_3 fetching through a 64-bit fetch buffer
+
+ Built from reve_r_subsystem_3 with subsystem_fetch64_enable set.
+*/
+extern
+module reve_r_subsystem_3_fetch64( clock clk,
+                                          input bit reset_n,
+                                          input bit proc_reset_n,
+                                          input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                          output t_reve_r_dmem_access_req  data_access_req,
+                                          input  t_reve_r_dmem_access_resp data_access_resp,
+                                          output t_apb_request           apb_request,
+                                          input  t_apb_response          apb_response,
+                                          input t_sram_access_req sram_access_req,
+                                          output t_sram_access_resp sram_access_resp,
+                                          input  t_reve_r_debug_mst               debug_mst,
+                                          output t_reve_r_debug_tgt               debug_tgt,
+                                          input  t_reve_r_config          riscv_config,
+                                          output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_bht64 - reve_r_subsystem_5 with a 64-entry branch history table
+
+ Built from reve_r_subsystem_5 with its branch predictor replaced by
+ reve_r_pipeline_control_branch_predictor_bht64.
+*/
+extern
+module reve_r_subsystem_5_bht64( clock clk,
+                                        input bit reset_n,
+                                        input bit proc_reset_n,
+                                        input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                        output t_reve_r_dmem_access_req  data_access_req,
+                                        input  t_reve_r_dmem_access_resp data_access_resp,
+                                        output t_apb_request           apb_request,
+                                        input  t_apb_response          apb_response,
+                                        input t_sram_access_req sram_access_req,
+                                        output t_sram_access_resp sram_access_resp,
+                                        input  t_reve_r_debug_mst               debug_mst,
+                                        output t_reve_r_debug_tgt               debug_tgt,
+                                        input  t_reve_r_config          riscv_config,
+                                        output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_prefetch - reve_r_subsystem_5 fetching through a prefetch queue
+
+ Built from reve_r_subsystem_5 with subsystem_prefetch_queue_enable set.
+*/
+extern
+module reve_r_subsystem_5_prefetch( clock clk,
+                                        input bit reset_n,
+                                        input bit proc_reset_n,
+                                        input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                        output t_reve_r_dmem_access_req  data_access_req,
+                                        input  t_reve_r_dmem_access_resp data_access_resp,
+                                        output t_apb_request           apb_request,
+                                        input  t_apb_response          apb_response,
+                                        input t_sram_access_req sram_access_req,
+                                        output t_sram_access_resp sram_access_resp,
+                                        input  t_reve_r_debug_mst               debug_mst,
+                                        output t_reve_r_debug_tgt               debug_tgt,
+                                        input  t_reve_r_config          riscv_config,
+                                        output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_icache - reve_r_subsystem_5 fetching through an instruction cache
+
+ Built from reve_r_subsystem_5 with subsystem_icache_enable set.
+*/
+extern
+module reve_r_subsystem_5_icache( clock clk,
+                                        input bit reset_n,
+                                        input bit proc_reset_n,
+                                        input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                        output t_reve_r_dmem_access_req  data_access_req,
+                                        input  t_reve_r_dmem_access_resp data_access_resp,
+                                        output t_apb_request           apb_request,
+                                        input  t_apb_response          apb_response,
+                                        input t_sram_access_req sram_access_req,
+                                        output t_sram_access_resp sram_access_resp,
+                                        input  t_reve_r_debug_mst               debug_mst,
+                                        output t_reve_r_debug_tgt               debug_tgt,
+                                        input  t_reve_r_config          riscv_config,
+                                        output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_bht1024 - reve_r_subsystem_5 with a 1024-entry branch history table
+
+ Built from reve_r_subsystem_5 with its branch predictor replaced by
+ reve_r_pipeline_control_branch_predictor_bht1024.
+*/
+extern
+module reve_r_subsystem_5_bht1024( clock clk,
+                                          input bit reset_n,
+                                          input bit proc_reset_n,
+                                          input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                          output t_reve_r_dmem_access_req  data_access_req,
+                                          input  t_reve_r_dmem_access_resp data_access_resp,
+                                          output t_apb_request           apb_request,
+                                          input  t_apb_response          apb_response,
+                                          input t_sram_access_req sram_access_req,
+                                          output t_sram_access_resp sram_access_resp,
+                                          input  t_reve_r_debug_mst               debug_mst,
+                                          output t_reve_r_debug_tgt               debug_tgt,
+                                          input  t_reve_r_config          riscv_config,
+                                          output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_gshare - reve_r_subsystem_5 with a 1024-entry gshare branch history table
+
+ Built from reve_r_subsystem_5 with its branch predictor replaced by
+ reve_r_pipeline_control_branch_predictor_gshare.
+*/
+extern
+module reve_r_subsystem_5_gshare( clock clk,
+                                         input bit reset_n,
+                                         input bit proc_reset_n,
+                                         input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                         output t_reve_r_dmem_access_req  data_access_req,
+                                         input  t_reve_r_dmem_access_resp data_access_resp,
+                                         output t_apb_request           apb_request,
+                                         input  t_apb_response          apb_response,
+                                         input t_sram_access_req sram_access_req,
+                                         output t_sram_access_resp sram_access_resp,
+                                         input  t_reve_r_debug_mst               debug_mst,
+                                         output t_reve_r_debug_tgt               debug_tgt,
+                                         input  t_reve_r_config          riscv_config,
+                                         output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_fold - reve_r_subsystem_5 with jump folding
+
+ Built from reve_r_subsystem_5 with its branch predictor replaced by
+ reve_r_pipeline_control_branch_predictor_fold.
+*/
+extern
+module reve_r_subsystem_5_fold( clock clk,
+                                       input bit reset_n,
+                                       input bit proc_reset_n,
+                                       input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                       output t_reve_r_dmem_access_req  data_access_req,
+                                       input  t_reve_r_dmem_access_resp data_access_resp,
+                                       output t_apb_request           apb_request,
+                                       input  t_apb_response          apb_response,
+                                       input t_sram_access_req sram_access_req,
+                                       output t_sram_access_resp sram_access_resp,
+                                       input  t_reve_r_debug_mst               debug_mst,
+                                       output t_reve_r_debug_tgt               debug_tgt,
+                                       input  t_reve_r_config          riscv_config,
+                                       output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_btb - reve_r_subsystem_5 with a branch target buffer
+
+ Built from reve_r_subsystem_5 with its branch predictor replaced by
+ reve_r_pipeline_control_branch_predictor_btb.
+*/
+extern
+module reve_r_subsystem_5_btb( clock clk,
+                                      input bit reset_n,
+                                      input bit proc_reset_n,
+                                      input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                      output t_reve_r_dmem_access_req  data_access_req,
+                                      input  t_reve_r_dmem_access_resp data_access_resp,
+                                      output t_apb_request           apb_request,
+                                      input  t_apb_response          apb_response,
+                                      input t_sram_access_req sram_access_req,
+                                      output t_sram_access_resp sram_access_resp,
+                                      input  t_reve_r_debug_mst               debug_mst,
+                                      output t_reve_r_debug_tgt               debug_tgt,
+                                      input  t_reve_r_config          riscv_config,
+                                      output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_ras - reve_r_subsystem_5 with a return address stack
+
+ Built from reve_r_subsystem_5 with its branch predictor replaced by
+ reve_r_pipeline_control_branch_predictor_ras.
+*/
+extern
+module reve_r_subsystem_5_ras( clock clk,
+                                      input bit reset_n,
+                                      input bit proc_reset_n,
+                                      input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                      output t_reve_r_dmem_access_req  data_access_req,
+                                      input  t_reve_r_dmem_access_resp data_access_resp,
+                                      output t_apb_request           apb_request,
+                                      input  t_apb_response          apb_response,
+                                      input t_sram_access_req sram_access_req,
+                                      output t_sram_access_resp sram_access_resp,
+                                      input  t_reve_r_debug_mst               debug_mst,
+                                      output t_reve_r_debug_tgt               debug_tgt,
+                                      input  t_reve_r_config          riscv_config,
+                                      output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_scoreboard - reve_r_subsystem_5 with a coprocessor scoreboard
+
+ Built from reve_r_subsystem_5 with its pipeline replaced by
+ reve_r_pipeline_d_e_m_w_scoreboard, so that a divide may retire
+ before its result is written back.
+*/
+extern
+module reve_r_subsystem_5_scoreboard( clock clk,
+                                             input bit reset_n,
+                                             input bit proc_reset_n,
+                                             input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                             output t_reve_r_dmem_access_req  data_access_req,
+                                             input  t_reve_r_dmem_access_resp data_access_resp,
+                                             output t_apb_request           apb_request,
+                                             input  t_apb_response          apb_response,
+                                             input t_sram_access_req sram_access_req,
+                                             output t_sram_access_resp sram_access_resp,
+                                             input  t_reve_r_debug_mst               debug_mst,
+                                             output t_reve_r_debug_tgt               debug_tgt,
+                                             input  t_reve_r_config          riscv_config,
+                                             output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_branch_resolve - reve_r_subsystem_5 resolving conditional branches in decode
+
+ Built from reve_r_subsystem_5 with its pipeline replaced by
+ reve_r_pipeline_d_e_m_w_branch_resolve.
+*/
+extern
+module reve_r_subsystem_5_branch_resolve( clock clk,
+                                                 input bit reset_n,
+                                                 input bit proc_reset_n,
+                                                 input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                                 output t_reve_r_dmem_access_req  data_access_req,
+                                                 input  t_reve_r_dmem_access_resp data_access_resp,
+                                                 output t_apb_request           apb_request,
+                                                 input  t_apb_response          apb_response,
+                                                 input t_sram_access_req sram_access_req,
+                                                 output t_sram_access_resp sram_access_resp,
+                                                 input  t_reve_r_debug_mst               debug_mst,
+                                                 output t_reve_r_debug_tgt               debug_tgt,
+                                                 input  t_reve_r_config          riscv_config,
+                                                 output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_jalr_target - reve_r_subsystem_5 calculating JALR targets in decode
+
+ Built from reve_r_subsystem_5 with its pipeline replaced by
+ reve_r_pipeline_d_e_m_w_jalr_target.
+*/
+extern
+module reve_r_subsystem_5_jalr_target( clock clk,
+                                              input bit reset_n,
+                                              input bit proc_reset_n,
+                                              input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                              output t_reve_r_dmem_access_req  data_access_req,
+                                              input  t_reve_r_dmem_access_resp data_access_resp,
+                                              output t_apb_request           apb_request,
+                                              input  t_apb_response          apb_response,
+                                              input t_sram_access_req sram_access_req,
+                                              output t_sram_access_resp sram_access_resp,
+                                              input  t_reve_r_debug_mst               debug_mst,
+                                              output t_reve_r_debug_tgt               debug_tgt,
+                                              input  t_reve_r_config          riscv_config,
+                                              output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_icache_load_forward - reve_r_subsystem_5 with an instruction cache and load-use forwarding
+
+ Built from reve_r_subsystem_5 with subsystem_icache_enable set and
+ its pipeline replaced by reve_r_pipeline_d_e_m_w_load_forward, so
+ that an instruction using the result of the load before it does not
+ wait for the load to reach RFW.
+*/
+extern
+module reve_r_subsystem_5_icache_load_forward( clock clk,
+                                                      input bit reset_n,
+                                                      input bit proc_reset_n,
+                                                      input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                                      output t_reve_r_dmem_access_req  data_access_req,
+                                                      input  t_reve_r_dmem_access_resp data_access_resp,
+                                                      output t_apb_request           apb_request,
+                                                      input  t_apb_response          apb_response,
+                                                      input t_sram_access_req sram_access_req,
+                                                      output t_sram_access_resp sram_access_resp,
+                                                      input  t_reve_r_debug_mst               debug_mst,
+                                                      output t_reve_r_debug_tgt               debug_tgt,
+                                                      input  t_reve_r_config          riscv_config,
+                                                      output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_icache_load_store_forward - reve_r_subsystem_5 with an instruction cache and load-use forwarding to store data
+
+ Built from reve_r_subsystem_5 with subsystem_icache_enable set and
+ its pipeline replaced by reve_r_pipeline_d_e_m_w_load_store_forward,
+ so that a store of the result of the load before it does not wait
+ for the load to reach RFW.
+*/
+extern
+module reve_r_subsystem_5_icache_load_store_forward( clock clk,
+                                                            input bit reset_n,
+                                                            input bit proc_reset_n,
+                                                            input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                                            output t_reve_r_dmem_access_req  data_access_req,
+                                                            input  t_reve_r_dmem_access_resp data_access_resp,
+                                                            output t_apb_request           apb_request,
+                                                            input  t_apb_response          apb_response,
+                                                            input t_sram_access_req sram_access_req,
+                                                            output t_sram_access_resp sram_access_resp,
+                                                            input  t_reve_r_debug_mst               debug_mst,
+                                                            output t_reve_r_debug_tgt               debug_tgt,
+                                                            input  t_reve_r_config          riscv_config,
+                                                            output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_5_icache_load_registered - reve_r_subsystem_5 with an instruction cache and registered load-use operands
+
+ Built from reve_r_subsystem_5 with subsystem_icache_enable set and
+ its pipeline replaced by reve_r_pipeline_d_e_m_w_load_registered, so
+ that memory stage results are registered into the ALU operands
+ rather than forwarded from RFW.
+*/
+extern
+module reve_r_subsystem_5_icache_load_registered( clock clk,
+                                                         input bit reset_n,
+                                                         input bit proc_reset_n,
+                                                         input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                                         output t_reve_r_dmem_access_req  data_access_req,
+                                                         input  t_reve_r_dmem_access_resp data_access_resp,
+                                                         output t_apb_request           apb_request,
+                                                         input  t_apb_response          apb_response,
+                                                         input t_sram_access_req sram_access_req,
+                                                         output t_sram_access_resp sram_access_resp,
+                                                         input  t_reve_r_debug_mst               debug_mst,
+                                                         output t_reve_r_debug_tgt               debug_tgt,
+                                                         input  t_reve_r_config          riscv_config,
+                                                         output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_dual - same as reve_r_subsystem_generic
+
+ This module includes the dual-issue Reve-r processor pipeline, with a
+ 64kB memory of two SRAM banks for instructions and data at address 0.
+ Peripherals are accessed at 1MB and above.
+*/
+extern
+module reve_r_subsystem_dual( clock clk,
+                                  input bit reset_n,
+                                  input bit proc_reset_n,
+                                  input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                  output t_reve_r_dmem_access_req  data_access_req,
+                                  input  t_reve_r_dmem_access_resp data_access_resp,
+                                  output t_apb_request           apb_request,
+                                  input  t_apb_response          apb_response,
+                                  input t_sram_access_req sram_access_req,
+                                  output t_sram_access_resp sram_access_resp,
+                                  input  t_reve_r_debug_mst               debug_mst,
+                                  output t_reve_r_debug_tgt               debug_tgt,
+                                  input  t_reve_r_config          riscv_config,
+                                  output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*m reve_r_subsystem_dual_fused - reve_r_subsystem_dual with macro-op fusion
+
+ Built from reve_r_subsystem_dual with its pipeline replaced by
+ reve_r_pipeline_dual_fused.
+*/
+extern
+module reve_r_subsystem_dual_fused( clock clk,
+                                    input bit reset_n,
+                                    input bit proc_reset_n,
+                                    input t_reve_r_irqs            irqs               "Interrupts in to the CPU",
+                                    output t_reve_r_dmem_access_req  data_access_req,
+                                    input  t_reve_r_dmem_access_resp data_access_resp,
+                                    output t_apb_request           apb_request,
+                                    input  t_apb_response          apb_response,
+                                    input t_sram_access_req sram_access_req,
+                                    output t_sram_access_resp sram_access_resp,
+                                    input  t_reve_r_debug_mst               debug_mst,
+                                    output t_reve_r_debug_tgt               debug_tgt,
+                                    input  t_reve_r_config          riscv_config,
+                                    output t_reve_r_trace           trace
+    )
+{
+    timing from rising clock clk apb_request;
+    timing to   rising clock clk apb_response;
+    timing from rising clock clk data_access_req;
+    timing to   rising clock clk data_access_resp;
+    timing to   rising clock clk sram_access_req;
+    timing from rising clock clk sram_access_resp;
+    timing to   rising clock clk riscv_config;
+    timing to   rising clock clk debug_mst;
+    timing from rising clock clk debug_tgt;
+    timing to   rising clock clk irqs;
+    timing from rising clock clk trace;
+    timing comb input riscv_config;
+    timing comb input data_access_resp;
+    timing comb input apb_response;
+    timing comb output trace;
+    timing comb output debug_tgt;
+}
+
+/*a Memories */
+/*m reve_r_sram_even_odd - 64kB SRAM of even and odd word banks, for straddling fetches
+ */
+extern
+module reve_r_sram_even_odd( clock sram_clock,
+                             input bit      reset_n,
+                             input bit      select,
+                             input bit      read_not_write,
+                             input bit[4]   write_enable,
+                             input bit[14]  address,
+                             input bit      straddle,
+                             input bit[32]  write_data,
+                             output bit[32] data_out,
+                             output bit[16] data_out_last16,
+                             output bit[64] data_out64
+    )
+{
+    timing to   rising clock sram_clock select, read_not_write, write_enable, address, straddle, write_data;
+    timing from rising clock sram_clock data_out, data_out_last16, data_out64;
+}
@@ -32,6 +32,8 @@ typedef struct {
     bit                trap          "Asserted if a trap is taken (including interrupt) - nonseq";
     bit                ret           "Asserted if an [m]ret instruction is taken - nonseq";
     bit                jalr          "Asserted if a jalr instruction is taken - nonseq";
+    bit                instr_paired  "Asserted if a second instruction retires with this one - sequential (dual-issue pipelines), or a folded jump if branch_taken is also asserted";
+    bit                branch_mispredict "Asserted if the instruction's branch was mispredicted (taken when predicted not, or vice versa), so the instructions fetched after it are discarded";
     // Following are valid at rfw stage of pipeline
     bit                rfw_retire "Asserted if an instruction is being retired";
     bit                rfw_data_valid;
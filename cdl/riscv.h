@@ -188,6 +188,7 @@ typedef enum[5] {
     riscv_opc_jal      = 27, // rv32i (jal)
     riscv_opc_system   = 28, // rv32i (ecall, ebreak, csrrw, csrrs, csrrc, csrrwi, csrrsi, csrrci)
     riscv_opc_resvd_2  = 29,
+    riscv_opc_op_p     = 29, // draft P (add8, add16, kadd16, cmpeq16, smin8, kmda, ...) - reserved in the ratified specification
     riscv_opc_custom_3 = 30
 } t_riscv_opc_rv32;
 
@@ -49,6 +49,7 @@ class DecodeModules(cdl_desc.Modules):
     modules += [ CdlModule("reve_r_e32_decode",                   cdl_filename="reve_r_i32_decode", constants={"rv_cfg_e32_force_enable":1}) ]
     modules += [ CdlModule("reve_r_i32c_decode") ]
     modules += [ CdlModule("reve_r_e32c_decode",                  cdl_filename="reve_r_i32c_decode", constants={"rv_cfg_e32_force_enable":1}) ]
+    modules += [ CdlModule("reve_r_i32_fuse") ]
     # modules += [ CdlModule("reve_r_debug_decode") ] This has been removed; the code is in i32_decode
     pass
 
@@ -65,8 +66,13 @@ class CoreModules(cdl_desc.Modules):
     modules = []
     modules += [ CdlModule("reve_r_alu") ]
     modules += [ CdlModule("reve_r_muldiv") ]
+    modules += [ CdlModule("reve_r_muldiv_fast_mul",              cdl_filename="reve_r_muldiv", constants={"muldiv_fast_multiply":1}) ]
+    modules += [ CdlModule("reve_r_muldiv_div_radix4",            cdl_filename="reve_r_muldiv", constants={"muldiv_div_radix4":1}) ]
+    modules += [ CdlModule("reve_r_clmul") ]
+    modules += [ CdlModule("reve_r_pmul") ]
     modules += [ CdlModule("reve_r_dmem_request") ]
     modules += [ CdlModule("reve_r_dmem_read_data") ]
+    modules += [ CdlModule("reve_r_dmem_atomic") ]
     pass
 
 class PipelineModules(cdl_desc.Modules):
@@ -84,6 +90,45 @@ class PipelineModules(cdl_desc.Modules):
     # The following includes decode (which is based on mode configs), and has a disableable compressed and coprocessor and e mode
     modules += [ CdlModule("reve_r_pipeline_dem_w") ]
     modules += [ CdlModule("reve_r_pipeline_d_e_m_w") ]
+    modules += [ CdlModule("reve_r_pipeline_d_e_m_w_scoreboard", cdl_filename="reve_r_pipeline_d_e_m_w", constants={"rv_cfg_coproc_scoreboard_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_d_e_m_w_load_forward", cdl_filename="reve_r_pipeline_d_e_m_w", constants={"rv_cfg_load_use_forward_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_d_e_m_w_load_registered", cdl_filename="reve_r_pipeline_d_e_m_w", constants={"rv_cfg_load_use_forward_registered_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_d_e_m_w_load_store_forward", cdl_filename="reve_r_pipeline_d_e_m_w", constants={"rv_cfg_load_use_forward_store_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_d_e_m_w_branch_resolve", cdl_filename="reve_r_pipeline_d_e_m_w", constants={"rv_cfg_dec_branch_resolve_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_d_e_m_w_jalr_target", cdl_filename="reve_r_pipeline_d_e_m_w", constants={"rv_cfg_dec_jalr_target_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_dual") ]
+    modules += [ CdlModule("reve_r_pipeline_dual_fused",          cdl_filename="reve_r_pipeline_dual", constants={"rv_cfg_i32_fuse_enable":1}) ]
+    pass
+
+class FetchModules(cdl_desc.Modules):
+    """
+    These are modules that sit on the instruction fetch interface between the pipeline control and the instruction memory
+    """
+    name = "fetch"
+    src_dir      = "cdl"
+    tb_src_dir   = "tb_cdl"
+    libraries = {"std":True}
+    cdl_include_dirs = ["cdl"]
+    export_dirs = cdl_include_dirs + [ src_dir ]
+    modules = []
+    modules += [ CdlModule("reve_r_loop_buffer") ]
+    modules += [ CdlModule("reve_r_prefetch_queue") ]
+    modules += [ CdlModule("reve_r_icache") ]
+    pass
+
+class DataMemoryModules(cdl_desc.Modules):
+    """
+    These are modules that sit on the data memory access interface between the pipeline control and the data memory
+    """
+    name = "dmem"
+    src_dir      = "cdl"
+    tb_src_dir   = "tb_cdl"
+    libraries = {"std":True}
+    cdl_include_dirs = ["cdl"]
+    export_dirs = cdl_include_dirs + [ src_dir ]
+    modules = []
+    modules += [ CdlModule("reve_r_dcache") ]
+    modules += [ CdlModule("reve_r_dcache_write_through",         cdl_filename="reve_r_dcache", constants={"dcache_write_back":0}) ]
     pass
 
 class PipelineControlModules(cdl_desc.Modules):
@@ -98,7 +143,16 @@ class PipelineControlModules(cdl_desc.Modules):
     modules = []
     modules += [ CdlModule("reve_r_pipeline_control") ]
     modules += [ CdlModule("reve_r_pipeline_control_fetch_req") ]
+    modules += [ CdlModule("reve_r_pipeline_control_branch_predictor") ]
+    modules += [ CdlModule("reve_r_pipeline_control_branch_predictor_bht64",   cdl_filename="reve_r_pipeline_control_branch_predictor", constants={"rv_cfg_bht_enable":1, "rv_cfg_bht_entries":64}) ]
+    modules += [ CdlModule("reve_r_pipeline_control_branch_predictor_bht1024", cdl_filename="reve_r_pipeline_control_branch_predictor", constants={"rv_cfg_bht_enable":1, "rv_cfg_bht_entries":1024}) ]
+    modules += [ CdlModule("reve_r_pipeline_control_branch_predictor_gshare",  cdl_filename="reve_r_pipeline_control_branch_predictor", constants={"rv_cfg_bht_enable":1, "rv_cfg_bht_entries":1024, "rv_cfg_bht_gshare_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_control_branch_predictor_fold",    cdl_filename="reve_r_pipeline_control_branch_predictor", constants={"rv_cfg_jump_fold_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_control_branch_predictor_btb",     cdl_filename="reve_r_pipeline_control_branch_predictor", constants={"rv_cfg_btb_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_control_branch_predictor_ras",     cdl_filename="reve_r_pipeline_control_branch_predictor", constants={"rv_cfg_ras_enable":1}) ]
+    modules += [ CdlModule("reve_r_pipeline_control_fetch_buffer") ]
     modules += [ CdlModule("reve_r_pipeline_control_fetch_data") ]
+    modules += [ CdlModule("reve_r_pipeline_control_fetch_data_dual") ]
     modules += [ CdlModule("reve_r_pipeline_control_flow") ]
     modules += [ CdlModule("reve_r_pipeline_trap_interposer") ]
     modules += [ CdlModule("reve_r_pipeline_debug") ]
@@ -116,8 +170,29 @@ class SubsystemModules(cdl_desc.Modules):
     cdl_include_dirs = ["cdl"]
     export_dirs = cdl_include_dirs + [ src_dir ]
     modules = []
+    modules += [ CdlModule("reve_r_sram_even_odd") ]
     modules += [ CdlModule("reve_r_subsystem_3") ]
+    modules += [ CdlModule("reve_r_subsystem_3_loop_buffer",     cdl_filename="reve_r_subsystem_3", constants={"rv_cfg_loop_buffer_enable":1}) ]
+    modules += [ CdlModule("reve_r_subsystem_3_fetch64",         cdl_filename="reve_r_subsystem_3", constants={"subsystem_fetch64_enable":1}) ]
     modules += [ CdlModule("reve_r_subsystem_5") ]
+    modules += [ CdlModule("reve_r_subsystem_5_zbc",             cdl_filename="reve_r_subsystem_5", constants={"subsystem_clmul_enable":1}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_pmul",            cdl_filename="reve_r_subsystem_5", constants={"subsystem_pmul_enable":1}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_bht64",           cdl_filename="reve_r_subsystem_5", instance_types={"reve_r_pipeline_control_branch_predictor":"reve_r_pipeline_control_branch_predictor_bht64"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_bht1024",         cdl_filename="reve_r_subsystem_5", instance_types={"reve_r_pipeline_control_branch_predictor":"reve_r_pipeline_control_branch_predictor_bht1024"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_gshare",          cdl_filename="reve_r_subsystem_5", instance_types={"reve_r_pipeline_control_branch_predictor":"reve_r_pipeline_control_branch_predictor_gshare"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_fold",            cdl_filename="reve_r_subsystem_5", instance_types={"reve_r_pipeline_control_branch_predictor":"reve_r_pipeline_control_branch_predictor_fold"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_btb",             cdl_filename="reve_r_subsystem_5", instance_types={"reve_r_pipeline_control_branch_predictor":"reve_r_pipeline_control_branch_predictor_btb"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_ras",             cdl_filename="reve_r_subsystem_5", instance_types={"reve_r_pipeline_control_branch_predictor":"reve_r_pipeline_control_branch_predictor_ras"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_scoreboard",      cdl_filename="reve_r_subsystem_5", instance_types={"reve_r_pipeline_d_e_m_w":"reve_r_pipeline_d_e_m_w_scoreboard"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_branch_resolve",  cdl_filename="reve_r_subsystem_5", instance_types={"reve_r_pipeline_d_e_m_w":"reve_r_pipeline_d_e_m_w_branch_resolve"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_jalr_target",     cdl_filename="reve_r_subsystem_5", instance_types={"reve_r_pipeline_d_e_m_w":"reve_r_pipeline_d_e_m_w_jalr_target"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_prefetch",        cdl_filename="reve_r_subsystem_5", constants={"subsystem_prefetch_queue_enable":1}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_icache",          cdl_filename="reve_r_subsystem_5", constants={"subsystem_icache_enable":1}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_icache_load_forward",    cdl_filename="reve_r_subsystem_5", constants={"subsystem_icache_enable":1}, instance_types={"reve_r_pipeline_d_e_m_w":"reve_r_pipeline_d_e_m_w_load_forward"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_icache_load_registered", cdl_filename="reve_r_subsystem_5", constants={"subsystem_icache_enable":1}, instance_types={"reve_r_pipeline_d_e_m_w":"reve_r_pipeline_d_e_m_w_load_registered"}) ]
+    modules += [ CdlModule("reve_r_subsystem_5_icache_load_store_forward", cdl_filename="reve_r_subsystem_5", constants={"subsystem_icache_enable":1}, instance_types={"reve_r_pipeline_d_e_m_w":"reve_r_pipeline_d_e_m_w_load_store_forward"}) ]
+    modules += [ CdlModule("reve_r_subsystem_dual") ]
+    modules += [ CdlModule("reve_r_subsystem_dual_fused",        cdl_filename="reve_r_subsystem_dual", instance_types={"reve_r_pipeline_dual":"reve_r_pipeline_dual_fused"}) ]
     pass
 
 class TraceModules(cdl_desc.Modules):
@@ -138,3 +213,89 @@ class TraceModules(cdl_desc.Modules):
     modules += [ CdlModule("reve_r_trace_decompression") ]
     pass
 
+
+class TestbenchModules(cdl_desc.Modules):
+    """
+    Self-checking testbenches, each of which runs a test program on a subsystem
+
+    Each is built from tb_reve_r_subsystem_generic, with the generic
+    subsystem and test program instances replaced by real modules
+    """
+    name = "tb"
+    src_dir      = "tb_cdl"
+    tb_src_dir   = "tb_cdl"
+    libraries = {"std":True}
+    cdl_include_dirs = ["cdl", "tb_cdl"]
+    export_dirs = cdl_include_dirs + [ src_dir ]
+    modules = []
+    modules += [ CdlModule("tb_riscv_i32_muldiv") ]
+    modules += [ CdlModule("tb_riscv_i32_muldiv_radix4", cdl_filename="tb_riscv_i32_muldiv", instance_types={"reve_r_muldiv":"reve_r_muldiv_div_radix4"}) ]
+    modules += [ CdlModule("tb_riscv_i32_muldiv_fast_mul", cdl_filename="tb_riscv_i32_muldiv", instance_types={"reve_r_muldiv":"reve_r_muldiv_fast_mul"}) ]
+    modules += [ CdlModule("tb_reve_r_dcache") ]
+    modules += [ CdlModule("tb_reve_r_dcache_write_through", cdl_filename="tb_reve_r_dcache", instance_types={"reve_r_dcache":"reve_r_dcache_write_through"}, constants={"tb_write_through":1}) ]
+    modules += [ CdlModule("tb_reve_r_program_branches") ]
+    modules += [ CdlModule("tb_reve_r_program_self_modifying") ]
+    modules += [ CdlModule("tb_reve_r_program_flush") ]
+    modules += [ CdlModule("tb_reve_r_program_refill") ]
+    modules += [ CdlModule("tb_reve_r_program_jumps") ]
+    modules += [ CdlModule("tb_reve_r_program_late_writeback") ]
+    modules += [ CdlModule("tb_reve_r_program_pairs") ]
+    modules += [ CdlModule("tb_reve_r_program_pair_issue") ]
+    modules += [ CdlModule("tb_reve_r_program_fusion") ]
+    modules += [ CdlModule("tb_reve_r_program_atomics") ]
+    modules += [ CdlModule("tb_reve_r_program_load_use") ]
+    modules += [ CdlModule("tb_reve_r_program_branch_targets") ]
+    modules += [ CdlModule("tb_reve_r_program_calls") ]
+    modules += [ CdlModule("tb_reve_r_program_resolve") ]
+    modules += [ CdlModule("tb_reve_r_program_jalr_targets") ]
+    modules += [ CdlModule("tb_reve_r_program_bitmanip") ]
+    modules += [ CdlModule("tb_reve_r_program_clmul") ]
+    modules += [ CdlModule("tb_reve_r_program_packed") ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_branches",       cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",       "tb_reve_r_program_generic":"tb_reve_r_program_branches"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_bht64_branches", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_bht64", "tb_reve_r_program_generic":"tb_reve_r_program_branches"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_bht1024_branches", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_bht1024", "tb_reve_r_program_generic":"tb_reve_r_program_branches"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_gshare_branches",  cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_gshare",  "tb_reve_r_program_generic":"tb_reve_r_program_branches"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_branch_targets",     cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",     "tb_reve_r_program_generic":"tb_reve_r_program_branch_targets"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_btb_branch_targets", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_btb", "tb_reve_r_program_generic":"tb_reve_r_program_branch_targets"}, constants={"tb_min_performance":16}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_calls",              cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",     "tb_reve_r_program_generic":"tb_reve_r_program_calls"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_ras_calls",          cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_ras", "tb_reve_r_program_generic":"tb_reve_r_program_calls"}, constants={"tb_min_performance":28}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_resolve",                cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",                "tb_reve_r_program_generic":"tb_reve_r_program_resolve"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_branch_resolve_resolve", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_branch_resolve", "tb_reve_r_program_generic":"tb_reve_r_program_resolve"}, constants={"tb_min_performance":32}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_jalr_targets",             cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",             "tb_reve_r_program_generic":"tb_reve_r_program_jalr_targets"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_jalr_target_jalr_targets", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_jalr_target", "tb_reve_r_program_generic":"tb_reve_r_program_jalr_targets"}, constants={"tb_min_performance":32}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_3_self_modifying",             cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_3",             "tb_reve_r_program_generic":"tb_reve_r_program_self_modifying"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_3_loop_buffer_self_modifying", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_3_loop_buffer", "tb_reve_r_program_generic":"tb_reve_r_program_self_modifying"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_3_fetch64_self_modifying",     cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_3_fetch64",     "tb_reve_r_program_generic":"tb_reve_r_program_self_modifying"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_3_refill",                     cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_3",             "tb_reve_r_program_generic":"tb_reve_r_program_refill"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_3_fetch64_refill",             cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_3_fetch64",     "tb_reve_r_program_generic":"tb_reve_r_program_refill"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_flush",                      cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",                "tb_reve_r_program_generic":"tb_reve_r_program_flush"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_prefetch_flush",             cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_prefetch",       "tb_reve_r_program_generic":"tb_reve_r_program_flush"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_prefetch_branches",          cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_prefetch",       "tb_reve_r_program_generic":"tb_reve_r_program_branches"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_refill",                     cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",                "tb_reve_r_program_generic":"tb_reve_r_program_refill"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_icache_refill",              cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_icache",         "tb_reve_r_program_generic":"tb_reve_r_program_refill"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_icache_flush",               cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_icache",         "tb_reve_r_program_generic":"tb_reve_r_program_flush"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_jumps",                      cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",                "tb_reve_r_program_generic":"tb_reve_r_program_jumps"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_fold_jumps",                 cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_fold",           "tb_reve_r_program_generic":"tb_reve_r_program_jumps"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_fold_jumps_single_step",     cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_fold",           "tb_reve_r_program_generic":"tb_reve_r_program_jumps"}, constants={"tb_single_step":1}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_late_writeback",             cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",                "tb_reve_r_program_generic":"tb_reve_r_program_late_writeback"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_pairs",                      cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",                "tb_reve_r_program_generic":"tb_reve_r_program_pairs"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_dual_pairs",                   cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_dual",             "tb_reve_r_program_generic":"tb_reve_r_program_pairs"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_dual_fused_pairs",             cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_dual_fused",       "tb_reve_r_program_generic":"tb_reve_r_program_pairs"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_dual_pairs_single_step",       cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_dual",             "tb_reve_r_program_generic":"tb_reve_r_program_pairs"}, constants={"tb_single_step":1}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_pair_issue",                 cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",                "tb_reve_r_program_generic":"tb_reve_r_program_pair_issue"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_dual_pair_issue",              cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_dual",             "tb_reve_r_program_generic":"tb_reve_r_program_pair_issue"}, constants={"tb_min_performance":48}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_dual_fusion",                  cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_dual",             "tb_reve_r_program_generic":"tb_reve_r_program_fusion"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_dual_fused_fusion",            cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_dual_fused",       "tb_reve_r_program_generic":"tb_reve_r_program_fusion"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_dual_fused_fusion_single_step", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_dual_fused",       "tb_reve_r_program_generic":"tb_reve_r_program_fusion"}, constants={"tb_single_step":1}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_3_atomics",                    cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_3",                "tb_reve_r_program_generic":"tb_reve_r_program_atomics"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_atomics",                    cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",                "tb_reve_r_program_generic":"tb_reve_r_program_atomics"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_bitmanip",                   cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5",                "tb_reve_r_program_generic":"tb_reve_r_program_bitmanip"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_dual_bitmanip",                cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_dual",             "tb_reve_r_program_generic":"tb_reve_r_program_bitmanip"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_zbc_clmul",                  cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_zbc",            "tb_reve_r_program_generic":"tb_reve_r_program_clmul"}, constants={"tb_i32_zbc":1}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_pmul_packed",                cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_pmul",           "tb_reve_r_program_generic":"tb_reve_r_program_packed"}, constants={"tb_i32p":1}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_scoreboard_late_writeback",  cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_scoreboard",     "tb_reve_r_program_generic":"tb_reve_r_program_late_writeback"}, constants={"tb_min_performance":32}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_icache_load_use",            cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_icache",         "tb_reve_r_program_generic":"tb_reve_r_program_load_use"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_icache_load_forward_load_use", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_icache_load_forward", "tb_reve_r_program_generic":"tb_reve_r_program_load_use"}, constants={"tb_min_performance":40}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_icache_load_registered_load_use", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_icache_load_registered", "tb_reve_r_program_generic":"tb_reve_r_program_load_use"}) ]
+    modules += [ CdlModule("tb_reve_r_subsystem_5_icache_load_store_forward_load_use", cdl_filename="tb_reve_r_subsystem_generic", instance_types={"reve_r_subsystem_generic":"reve_r_subsystem_5_icache_load_store_forward", "tb_reve_r_program_generic":"tb_reve_r_program_load_use"}, constants={"tb_min_performance":16}) ]
+    pass
@@ -0,0 +1,43 @@
+/** @copyright (C) 2016-2020,  Gavin J Stark.  All rights reserved.
+ *
+ * @copyright
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0.
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ * @file   tb_reve_r.h
+ * @brief  Header file for the Reve-R subsystem testbenches
+ *
+ */
+
+/*a Test programs */
+/*m tb_reve_r_program_generic - Generic test program ROM
+
+ A test program is a ROM of num_words words, written to address 0
+ of the subsystem SRAM before the processor is released from reset.
+
+ A program may request patches (by number, from 1) to be written
+ through the SRAM access port while it is running; each patch is a
+ single word, at patch_address.
+
+ Each program is self-checking, and writes 0 to the testbench result
+ register if it passes.
+*/
+extern
+module tb_reve_r_program_generic( input bit[14]  address       "Word address in the program",
+                                  output bit[32] data          "Program word at the address",
+                                  output bit[14] num_words     "Number of words in the program",
+                                  input bit[4]   patch_number  "Patch number requested by the program",
+                                  output bit[32] patch_address "Byte address of the word to be patched",
+                                  output bit[32] patch_data    "Data to write to the patch address"
+    )
+{
+    timing comb input address, patch_number;
+    timing comb output data, num_words, patch_address, patch_data;
+}